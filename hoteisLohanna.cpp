@@ -4,86 +4,95 @@
 #include <stdexcept>
 #include <fstream>
 #include <algorithm>
+#include <map>
+#include <unordered_set>
+#include <memory>
+#include <mutex>
+#include <future>
+#include <cctype>
+#include <iterator>
 
 //using namespace std para evitar std:: em todo o código
 using namespace std;
 class Atendente; 
 
-// ============================ PADRÃO ESTRATÉGIA DE DESCONTO =========================
-// Interface base para estratégias de desconto
-class PoliticasdeDesconto
-{
-public:
-    virtual void calcular(float *valor) = 0;
-    virtual ~PoliticasdeDesconto() {}
-};
+// ============================ CATÁLOGO (TEMPO DE COMPILAÇÃO) =========================
+// Localidades, quartos e políticas de desconto ficam em tabelas constexpr.
+// Menus, validação das opções e cálculo de preço são todos gerados a partir delas.
+
+// Localidades atendidas (cada uma vira um shard no roteador)
+constexpr const char *LOCALIDADES[] = {"Jericoacoara", "Canoa Quebrada", "Cumbuco"};
+constexpr int NUM_LOCALIDADES = sizeof(LOCALIDADES) / sizeof(LOCALIDADES[0]);
 
-// Estratégia: Sem desconto
-class SemDesconto : public PoliticasdeDesconto
+// Tipo de quarto: nome, capacidade (hóspedes) e valor da diária em reais
+struct TipoDeQuarto
 {
-public:
-    void calcular(float *valor) override
-    {
-        cout << "Esse cliente não tem desconto..." << endl;
-    }
+    const char *nome;
+    int capacidade;
+    int diaria;
 };
 
-// Estratégia: Cliente VIP (10% de desconto)
-class ClientesVIP : public PoliticasdeDesconto
+constexpr TipoDeQuarto QUARTOS[] = {
+    {"Solteiro", 1, 200},
+    {"Duplo", 2, 300},
+    {"Casal", 2, 350},
+    {"Triplo", 3, 450},
+    {"Quádruplo", 4, 550}};
+constexpr int NUM_QUARTOS = sizeof(QUARTOS) / sizeof(QUARTOS[0]);
+
+// ============================ TABELA DE DESCONTOS =========================
+// Cada política de desconto é uma linha da tabela; a escolha é feita em tempo
+// de execução pelo índice da linha, sem alocação nem chamada virtual.
+struct PoliticaDeDesconto
 {
-public:
-    void calcular(float *valor) override
-    {
-        cout << "Esse cliente tem 10% de desconto." << endl;
-        *valor = *valor * 0.90;
-    }
+    const char *nome;
+    int percentual;
 };
 
-// Estratégia: Baixa Temporada (20% de desconto)
-class BaixaTemporada : public PoliticasdeDesconto
+constexpr PoliticaDeDesconto DESCONTOS[] = {
+    {"Sem desconto", 0},
+    {"Cliente VIP", 10},
+    {"Baixa Temporada", 20},
+    {"Promoção de Feriado", 15}};
+constexpr int NUM_DESCONTOS = sizeof(DESCONTOS) / sizeof(DESCONTOS[0]);
+
+// Converte a opção do menu (1..N) em índice da tabela; -1 se inválida
+constexpr int indiceDaOpcao(int opcao, int total)
 {
-public:
-    void calcular(float *valor) override
-    {
-        cout << "Esse cliente tem 20% de desconto" << endl;
-        *valor = *valor * 0.80;
-    }
-};
+    return (opcao >= 1 && opcao <= total) ? opcao - 1 : -1;
+}
 
-// Estratégia: Promoção de Feriado (15% de desconto)
-class PromFeriado : public PoliticasdeDesconto{
-public:
-    void calcular(float *valor) override
-    {
-        cout << "Esse cliente tem 15% de desconto" << endl;
-        *valor = *valor * 0.85;
-    }
-};
+// Opções inválidas de desconto caem na primeira linha da tabela ("Sem desconto")
+constexpr int descontoDaOpcao(int opcao)
+{
+    return indiceDaOpcao(opcao, NUM_DESCONTOS) < 0 ? 0 : opcao - 1;
+}
 
-// Contexto para aplicar a estratégia de desconto
-class Desconto
+// Valor total da estadia já com desconto. A multiplicação é feita em long long
+// para não estourar com muitas diárias, e a divisão uma única vez no final.
+constexpr float calcularCotacao(int quarto, int numeroDiarias, int desconto)
 {
-private:
-    PoliticasdeDesconto *estrategia;
+    return static_cast<float>(static_cast<long long>(QUARTOS[quarto].diaria) * numeroDiarias *
+                              (100 - DESCONTOS[desconto].percentual) / 100.0);
+}
 
-public:
-    Desconto() { this->estrategia = nullptr; }
-    void calcularDesconto(float *valor)
-    {
-        if (this->estrategia != nullptr)
-        {
-            estrategia->calcular(valor);
-        }
-        else
-        {
-            cout << "nenhuma estrategia foi definida" << endl;
-        }
-    }
-    void setDesconto(PoliticasdeDesconto *novaEstrategia)
-    {
-        this->estrategia = novaEstrategia;
-    }
-};
+// Conferência dos preços (índices: quarto e linha de DESCONTOS)
+static_assert(DESCONTOS[0].percentual == 0, "a primeira linha de DESCONTOS deve ser \"Sem desconto\"");
+static_assert(calcularCotacao(0, 3, 1) == 540.0f, "Solteiro, 3 diárias, VIP");
+static_assert(calcularCotacao(2, 6, 3) == 1785.0f, "Casal, 6 diárias, feriado");
+static_assert(calcularCotacao(4, 1, 2) == 440.0f, "Quádruplo, 1 diária, baixa temporada");
+static_assert(calcularCotacao(1, 2, 0) == 600.0f, "Duplo, 2 diárias, sem desconto");
+static_assert(calcularCotacao(4, 40000, 0) == 22000000.0f, "Quádruplo, 40000 diárias, sem estouro");
+static_assert(calcularCotacao(4, 1000000, 1) == 495000000.0f, "Quádruplo, 1000000 diárias, VIP");
+
+// Mensagem exibida ao aplicar a política escolhida
+inline void anunciarDesconto(int desconto)
+{
+    if (DESCONTOS[desconto].percentual == 0)
+        cout << "Esse cliente não tem desconto..." << endl;
+    else
+        cout << "Esse cliente tem " << DESCONTOS[desconto].percentual << "% de desconto." << endl;
+}
 
 // ============================ CLASSE RESERVA =========================
 // Representa uma reserva de hotel
@@ -111,78 +120,124 @@ public:
     void setConfirmada(bool status);
     string getLocalidade() const;
     string getCliente() const { return cliente; }
+    string getCpf() const { return cpf; }
     string getTipoQuarto() const;
     bool isConfirmada() const;
 };
 
-// ============================ SINGLETON: CONTROLADOR DE RESERVAS =========================
-// Gerencia todas as reservas do sistema (Singleton)
+// ============================ SHARD: CONTROLADOR DE RESERVAS =========================
+// Gerencia as reservas de uma única localidade (um shard por localidade).
+// Cada shard tem seu próprio arquivo, índice de disponibilidade e trava,
+// então operações em localidades diferentes não disputam entre si.
 class ControladorDeReservas
 {
 private:
-    static ControladorDeReservas *instancia;
+    string localidade;
+    string nomeArquivo;
     vector<Reserva> reservas;
+    unordered_set<string> ocupados; // índice: "data|tipo" das reservas confirmadas
+    bool alterado;
+    mutable mutex trava;
 
-    ControladorDeReservas() {}
+    static string chave(const string &dataCheckin, const string &tipoQuarto)
+    {
+        return dataCheckin + "|" + tipoQuarto;
+    }
 
-public:
-    // Retorna a instância única do controlador
-    static ControladorDeReservas *getInstancia()
+    // Insere a reserva e atualiza o índice (chamar com a trava adquirida)
+    void inserir(const Reserva &r)
     {
-        if (!instancia)
+        reservas.push_back(r);
+        if (r.isConfirmada())
         {
-            instancia = new ControladorDeReservas();
+            ocupados.insert(chave(r.getDataCheckin(), r.getTipoQuarto()));
         }
-        return instancia;
     }
 
-    // Verifica se já existe reserva com mesmos: localidade, tipo e data
-    bool verificarDisponibilidade(string localidade, string dataCheckin, string tipoQuarto)
+    // Verifica se já existe reserva confirmada com mesmos: tipo e data (chamar com a trava adquirida)
+    bool verificarDisponibilidade(const string &dataCheckin, const string &tipoQuarto) const
     {
-        for (const Reserva &r : reservas)
-        {
-            if (r.getDataCheckin() == dataCheckin &&
-                r.getLocalidade() == localidade &&
-                r.getTipoQuarto() == tipoQuarto &&
-                r.isConfirmada())
-            {
-                return false; // já está reservado
-            }
-        }
-        return true; // está disponível
+        return ocupados.count(chave(dataCheckin, tipoQuarto)) == 0;
     }
 
-    // Cria uma nova reserva e adiciona ao vetor
-    Reserva criarReserva(string atendente, string cliente, string cpf, string localidade,
+public:
+    ControladorDeReservas(const string &localidade, const string &nomeArquivo)
+    {
+        this->localidade = localidade;
+        this->nomeArquivo = nomeArquivo;
+        this->alterado = false;
+    }
+
+    ControladorDeReservas(const ControladorDeReservas &) = delete;
+    ControladorDeReservas &operator=(const ControladorDeReservas &) = delete;
+
+    const string &getLocalidade() const { return localidade; }
+    const string &getNomeArquivo() const { return nomeArquivo; }
+
+    // Cria uma nova reserva e adiciona ao shard
+    Reserva criarReserva(string atendente, string cliente, string cpf,
                          string tipoQuarto, string dataCheckin, int numeroDiarias,
                          float valorTotal, float valorEntrada)
     {
-        if (!verificarDisponibilidade(localidade, dataCheckin, tipoQuarto))
+        lock_guard<mutex> lock(trava);
+        if (!verificarDisponibilidade(dataCheckin, tipoQuarto))
         {
             throw runtime_error("Quarto indisponível para essa data/localidade.");
         }
 
         Reserva r(atendente, cliente, cpf, localidade, tipoQuarto, dataCheckin, numeroDiarias, valorTotal, valorEntrada);
         r.setConfirmada(false); // pode deixar como false se quiser controle de pagamento
-        reservas.push_back(r);
+        inserir(r);
+        alterado = true;
         cout << "Reserva realizada, falta realizar pagamento para a confirmação...!" << endl;
         return r;
     }
 
-    // Retorna todas as reservas
-    const vector<Reserva> &getReservas() const
+    // Adiciona uma reserva já existente (carregamento/migração)
+    void adicionarReserva(const Reserva &r)
+    {
+        lock_guard<mutex> lock(trava);
+        inserir(r);
+        alterado = true;
+    }
+
+    // Retorna uma cópia das reservas do shard
+    vector<Reserva> getReservas() const
     {
+        lock_guard<mutex> lock(trava);
         return reservas;
     }
 
+    // Retorna as reservas do shard feitas para um CPF
+    vector<Reserva> buscarPorCpf(const string &cpf) const
+    {
+        lock_guard<mutex> lock(trava);
+        vector<Reserva> encontradas;
+        for (const Reserva &r : reservas)
+        {
+            if (r.getCpf() == cpf)
+            {
+                encontradas.push_back(r);
+            }
+        }
+        return encontradas;
+    }
+
     // Confirma uma reserva pelo nome do cliente
     bool confirmarReservaPorNome(const string &nomeCliente);
 
-    // Salva todas as reservas em arquivo, ordenadas por data de check-in
-    void salvarReservasEmArquivo(const string &nomeArquivo)
+    // Salva as reservas do shard em seu arquivo, ordenadas por data de check-in.
+    // Shards sem alterações desde o último salvamento não são reescritos.
+    void salvarReservasEmArquivo()
     {
-        // Copia as reservas para ordenar
-        vector<Reserva> ordenadas = reservas;
+        vector<Reserva> ordenadas;
+        {
+            lock_guard<mutex> lock(trava);
+            if (!alterado)
+                return;
+            ordenadas = reservas;
+            alterado = false;
+        }
         // Ordena por dataCheckin (formato DD/MM/AAAA)
         sort(ordenadas.begin(), ordenadas.end(), [](const Reserva &a, const Reserva &b)
              { return a.getDataCheckin() < b.getDataCheckin(); });
@@ -191,6 +246,8 @@ public:
         if (!arquivo)
         {
             cout << "Erro ao abrir arquivo para salvar reservas.\n";
+            lock_guard<mutex> lock(trava);
+            alterado = true;
             return;
         }
 
@@ -202,12 +259,13 @@ public:
         cout << "Reservas salvas em arquivo: " << nomeArquivo << endl;
     }
 
-    // Carrega reservas do arquivo para o sistema
-    void carregarReservasDeArquivo(const string &nomeArquivo)
+    // Lê reservas de um arquivo no formato de getResumo()
+    static vector<Reserva> lerReservasDeArquivo(const string &nomeArquivo)
     {
+        vector<Reserva> lidas;
         ifstream arquivo(nomeArquivo);
         if (!arquivo)
-            return; // Arquivo não existe, nada a carregar
+            return lidas; // Arquivo não existe, nada a carregar
 
         string linha, atendente, cliente, cpf, localidade, tipoQuarto, dataCheckin, status;
         int numeroDiarias;
@@ -245,21 +303,48 @@ public:
             {
                 Reserva r(atendente, cliente, cpf, localidade, tipoQuarto, dataCheckin, numeroDiarias, valorTotal, valorEntrada);
                 r.setConfirmada(status == "Confirmada");
-                reservas.push_back(r);
+                lidas.push_back(r);
             }
         }
         arquivo.close();
+        return lidas;
+    }
+
+    // Carrega as reservas do arquivo do shard. Linhas de outra localidade não
+    // entram neste shard: são devolvidas para o roteador redistribuir.
+    vector<Reserva> carregarReservasDeArquivo()
+    {
+        vector<Reserva> lidas = lerReservasDeArquivo(nomeArquivo);
+        vector<Reserva> deOutraLocalidade;
+        lock_guard<mutex> lock(trava);
+        for (const Reserva &r : lidas)
+        {
+            if (r.getLocalidade() != localidade)
+            {
+                deOutraLocalidade.push_back(r);
+                continue;
+            }
+            inserir(r);
+        }
+        if (!deOutraLocalidade.empty())
+        {
+            alterado = true; // regrava o arquivo sem as linhas que foram para outro shard
+        }
+        return deOutraLocalidade;
     }
 };
 
 // Implementação do método para confirmar reserva pelo nome
 bool ControladorDeReservas::confirmarReservaPorNome(const string &nomeCliente)
 {
+    lock_guard<mutex> lock(trava);
     for (Reserva &r : reservas)
     {
         if (r.getCliente() == nomeCliente)
         {
             r.setConfirmada(true);
+            ocupados.insert(chave(r.getDataCheckin(), r.getTipoQuarto()));
+            alterado = true;
             cout << "Reserva de \"" << nomeCliente << "\" confirmada com sucesso.\n";
             return true;
         }
@@ -268,8 +353,187 @@ bool ControladorDeReservas::confirmarReservaPorNome(const string &nomeCliente)
     return false; // Nenhuma reserva com esse nome encontrada
 }
 
-// Inicialização do ponteiro estático do singleton
-ControladorDeReservas *ControladorDeReservas::instancia = nullptr;
+// ============================ SINGLETON: ROTEADOR DE RESERVAS =========================
+// Mantém um shard por localidade e despacha cada operação para o shard certo (Singleton).
+// Consultas que cruzam localidades (ex.: por CPF) são feitas em paralelo.
+class RoteadorDeReservas
+{
+private:
+    static RoteadorDeReservas *instancia;
+    // Montados no construtor e nunca alterados depois: o roteamento não precisa de trava.
+    // Os shards ficam na ordem do catálogo; o mapa só indexa localidade -> posição.
+    vector<unique_ptr<ControladorDeReservas>> shards;
+    map<string, size_t> indiceDaLocalidade;
+
+    // Arquivo único usado antes da divisão por localidade
+    static const string arquivoLegado;
+
+    RoteadorDeReservas()
+    {
+        for (const string &localidade : getLocalidades())
+        {
+            indiceDaLocalidade[localidade] = shards.size();
+            shards.push_back(unique_ptr<ControladorDeReservas>(
+                new ControladorDeReservas(localidade, nomeArquivoDe(localidade))));
+        }
+    }
+
+    // "Canoa Quebrada" -> "reservas_canoa_quebrada.csv"
+    static string nomeArquivoDe(const string &localidade)
+    {
+        string nome = "reservas_";
+        for (char c : localidade)
+        {
+            nome += (c == ' ') ? '_' : static_cast<char>(tolower(static_cast<unsigned char>(c)));
+        }
+        return nome + ".csv";
+    }
+
+    // Executa a consulta em todos os shards em paralelo e junta os resultados
+    template <typename Consulta>
+    vector<Reserva> consultarTodos(Consulta consulta) const
+    {
+        vector<future<vector<Reserva>>> parciais;
+        for (const unique_ptr<ControladorDeReservas> &s : shards)
+        {
+            const ControladorDeReservas *shard = s.get();
+            parciais.push_back(async(launch::async, [shard, consulta]()
+                                     { return consulta(*shard); }));
+        }
+
+        vector<Reserva> resultado;
+        for (future<vector<Reserva>> &parcial : parciais)
+        {
+            vector<Reserva> r = parcial.get();
+            resultado.insert(resultado.end(), r.begin(), r.end());
+        }
+        return resultado;
+    }
+
+    // Adiciona cada reserva ao shard da sua localidade; localidades fora do catálogo são descartadas
+    void distribuir(const vector<Reserva> &reservas)
+    {
+        for (const Reserva &r : reservas)
+        {
+            try
+            {
+                getShard(r.getLocalidade())->adicionarReserva(r);
+            }
+            catch (const invalid_argument &e)
+            {
+                cout << "Reserva ignorada: " << e.what() << endl;
+            }
+        }
+    }
+
+public:
+    // Retorna a instância única do roteador
+    static RoteadorDeReservas *getInstancia()
+    {
+        if (!instancia)
+        {
+            instancia = new RoteadorDeReservas();
+        }
+        return instancia;
+    }
+
+    // Localidades atendidas (uma por shard), vindas do catálogo
+    static const vector<string> &getLocalidades()
+    {
+        static const vector<string> localidades(begin(LOCALIDADES), end(LOCALIDADES));
+        return localidades;
+    }
+
+    // Retorna o shard responsável pela localidade
+    ControladorDeReservas *getShard(const string &localidade) const
+    {
+        auto it = indiceDaLocalidade.find(localidade);
+        if (it == indiceDaLocalidade.end())
+        {
+            throw invalid_argument("Localidade desconhecida: " + localidade);
+        }
+        return shards[it->second].get();
+    }
+
+    // Cria uma nova reserva no shard da localidade
+    Reserva criarReserva(string atendente, string cliente, string cpf, string localidade,
+                         string tipoQuarto, string dataCheckin, int numeroDiarias,
+                         float valorTotal, float valorEntrada)
+    {
+        return getShard(localidade)->criarReserva(atendente, cliente, cpf, tipoQuarto, dataCheckin,
+                                                  numeroDiarias, valorTotal, valorEntrada);
+    }
+
+    // Retorna todas as reservas, agrupadas por localidade na ordem do catálogo
+    vector<Reserva> getReservas() const
+    {
+        return consultarTodos([](const ControladorDeReservas &shard)
+                              { return shard.getReservas(); });
+    }
+
+    // Retorna as reservas de um CPF em todas as localidades
+    vector<Reserva> buscarPorCpf(const string &cpf) const
+    {
+        return consultarTodos([cpf](const ControladorDeReservas &shard)
+                              { return shard.buscarPorCpf(cpf); });
+    }
+
+    // Confirma a primeira reserva encontrada com o nome do cliente,
+    // percorrendo as localidades na ordem do catálogo
+    bool confirmarReservaPorNome(const string &nomeCliente)
+    {
+        for (unique_ptr<ControladorDeReservas> &shard : shards)
+        {
+            if (shard->confirmarReservaPorNome(nomeCliente))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Salva os shards que tiveram alterações, cada um em seu arquivo
+    void salvarReservas()
+    {
+        for (unique_ptr<ControladorDeReservas> &shard : shards)
+        {
+            shard->salvarReservasEmArquivo();
+        }
+    }
+
+    // Carrega todos os shards em paralelo, movendo para o shard certo as linhas que
+    // estavam no arquivo de outra localidade. Se nenhum arquivo por localidade
+    // existir ainda, distribui as reservas do antigo reservas.csv entre os shards.
+    void carregarReservas()
+    {
+        bool algumArquivo = false;
+        vector<future<vector<Reserva>>> cargas;
+        for (unique_ptr<ControladorDeReservas> &s : shards)
+        {
+            ControladorDeReservas *shard = s.get();
+            if (ifstream(shard->getNomeArquivo()))
+            {
+                algumArquivo = true;
+            }
+            cargas.push_back(async(launch::async, [shard]()
+                                   { return shard->carregarReservasDeArquivo(); }));
+        }
+        // Linhas gravadas no arquivo de outra localidade vão para o shard certo
+        for (future<vector<Reserva>> &carga : cargas)
+        {
+            distribuir(carga.get());
+        }
+
+        if (algumArquivo)
+            return;
+
+        distribuir(ControladorDeReservas::lerReservasDeArquivo(arquivoLegado));
+    }
+};
+
+// Inicialização dos membros estáticos do roteador
+RoteadorDeReservas *RoteadorDeReservas::instancia = nullptr;
+const string RoteadorDeReservas::arquivoLegado = "reservas.csv";
 
 // ============================ CLASSE ATENDENTE =========================
 // Representa um atendente do hotel
@@ -371,7 +635,6 @@ void Reserva::fazerReserva(Atendente &autenticado)
     int numeroDiarias, tipoDesconto;
     float valorTotal = 0.0f;
     float valorEntrada = 0.0f;
-    float precoBase = 0.0f;
 
     cout << "Nome do cliente: ";
     getline(cin, cliente);
@@ -381,66 +644,40 @@ void Reserva::fazerReserva(Atendente &autenticado)
 
     int opcaoLocal;
     cout << "Escolha a localidade:\n";
-    cout << "1 - Jericoacoara\n";
-    cout << "2 - Canoa Quebrada\n";
-    cout << "3 - Cumbuco\n";
+    for (int i = 0; i < NUM_LOCALIDADES; i++)
+    {
+        cout << i + 1 << " - " << LOCALIDADES[i] << "\n";
+    }
     cout << "Opção: ";
     cin >> opcaoLocal;
     cin.ignore();
 
-    switch (opcaoLocal)
-    {
-    case 1:
-        localidade = "Jericoacoara";
-        break;
-    case 2:
-        localidade = "Canoa Quebrada";
-        break;
-    case 3:
-        localidade = "Cumbuco";
-        break;
-    default:
+    int indiceLocal = indiceDaOpcao(opcaoLocal, NUM_LOCALIDADES);
+    if (indiceLocal < 0)
+    {
         cout << "Opção inválida para localidade.\n";
         return;
     }
+    localidade = LOCALIDADES[indiceLocal];
 
     int opcaoQuarto;
     cout << "Escolha o tipo de quarto:\n";
-    cout << "1 - Solteiro (R$200)\n";
-    cout << "2 - Duplo (R$300)\n";
-    cout << "3 - Casal (R$350)\n";
-    cout << "4 - Triplo (R$450)\n";
-    cout << "5 - Quádruplo (R$550)\n";
+    for (int i = 0; i < NUM_QUARTOS; i++)
+    {
+        cout << i + 1 << " - " << QUARTOS[i].nome << " (R$" << QUARTOS[i].diaria << ", "
+             << QUARTOS[i].capacidade << (QUARTOS[i].capacidade == 1 ? " hóspede" : " hóspedes") << ")\n";
+    }
     cout << "Opção: ";
     cin >> opcaoQuarto;
     cin.ignore();
 
-    switch (opcaoQuarto)
-    {
-    case 1:
-        tipoQuarto = "Solteiro";
-        precoBase = 200;
-        break;
-    case 2:
-        tipoQuarto = "Duplo";
-        precoBase = 300;
-        break;
-    case 3:
-        tipoQuarto = "Casal";
-        precoBase = 350;
-        break;
-    case 4:
-        tipoQuarto = "Triplo";
-        precoBase = 450;
-        break;
-    case 5:
-        tipoQuarto = "Quádruplo";
-        precoBase = 550;
-        break;
-    default:
+    int indiceQuarto = indiceDaOpcao(opcaoQuarto, NUM_QUARTOS);
+    if (indiceQuarto < 0)
+    {
         cout << "Opção inválida para tipo de quarto.\n";
         return;
     }
+    tipoQuarto = QUARTOS[indiceQuarto].nome;
 
     // ============================ ENTRADA DE DATA E DIÁRIAS =========================
     cout << "Data de check-in (DD/MM/AAAA): ";
@@ -449,42 +686,32 @@ void Reserva::fazerReserva(Atendente &autenticado)
     cout << "Número de diárias: ";
     cin >> numeroDiarias;
 
-    // ============================ CÁLCULO DE DESCONTO =========================
-    float valorSemDesconto = precoBase * numeroDiarias;
-    Desconto desconto;
+    if (numeroDiarias <= 0)
+    {
+        cout << "Número de diárias inválido.\n";
+        return;
+    }
 
+    // ============================ CÁLCULO DE DESCONTO =========================
     cout << "Selecione o tipo de desconto:\n";
-    cout << "1 - Sem desconto\n";
-    cout << "2 - Cliente VIP (10%)\n";
-    cout << "3 - Baixa Temporada (20%)\n";
-    cout << "4 - Promoção de Feriado (15%)\n";
+    for (int i = 0; i < NUM_DESCONTOS; i++)
+    {
+        cout << i + 1 << " - " << DESCONTOS[i].nome;
+        if (DESCONTOS[i].percentual > 0)
+            cout << " (" << DESCONTOS[i].percentual << "%)";
+        cout << "\n";
+    }
     cout << "Opção: ";
     cin >> tipoDesconto;
 
-    // ============================ ESCOLHA DO TIPO DE DESCONTO =========================
-    switch (tipoDesconto)
-    {
-    case 2:
-        desconto.setDesconto(new ClientesVIP());
-        break;
-    case 3:
-        desconto.setDesconto(new BaixaTemporada());
-        break;
-    case 4:
-        desconto.setDesconto(new PromFeriado());
-        break;
-    default:
-        desconto.setDesconto(new SemDesconto());
-        break;
-    }
-
-    desconto.calcularDesconto(&valorSemDesconto);
-    valorTotal = valorSemDesconto;
+    int desconto = descontoDaOpcao(tipoDesconto);
+    anunciarDesconto(desconto);
+    valorTotal = calcularCotacao(indiceQuarto, numeroDiarias, desconto);
     valorEntrada = valorTotal / 3.0f;
 
     try
     {
-        ControladorDeReservas *sistema = ControladorDeReservas::getInstancia();
+        RoteadorDeReservas *sistema = RoteadorDeReservas::getInstancia();
         Reserva nova = sistema->criarReserva(
             autenticado.getLogin(),
             cliente, cpf, localidade,
@@ -548,7 +775,7 @@ int main()
                  << endl;
             autenticadoFlag = true;
             // Carrega reservas do arquivo ao iniciar
-            ControladorDeReservas::getInstancia()->carregarReservasDeArquivo("reservas.csv");
+            RoteadorDeReservas::getInstancia()->carregarReservas();
         }
         else
         {
@@ -568,6 +795,7 @@ int main()
              << "2 - Reservar uma data para um cliente" << endl
              << "3 - Sair" << endl
              << "4 - Confirmar uma reserva (pagamento)" << endl
+             << "5 - Buscar reservas por CPF" << endl
              << "Escolha: ";
 
         cin >> user_escolha;
@@ -575,8 +803,8 @@ int main()
         // ============================ VERIFICAR RESERVAS =========================
         if (user_escolha == 1)
         {
-            ControladorDeReservas *sistema = ControladorDeReservas::getInstancia();
-            const vector<Reserva> &reservas = sistema->getReservas();
+            RoteadorDeReservas *sistema = RoteadorDeReservas::getInstancia();
+            const vector<Reserva> reservas = sistema->getReservas();
 
             if (reservas.empty())
             {
@@ -628,7 +856,7 @@ int main()
             cout << "Digite o nome do cliente para confirmar a reserva: ";
             getline(cin, nomeBusca);
 
-            ControladorDeReservas *sistema = ControladorDeReservas::getInstancia();
+            RoteadorDeReservas *sistema = RoteadorDeReservas::getInstancia();
             bool sucesso = sistema->confirmarReservaPorNome(nomeBusca);
 
             if (!sucesso)
@@ -637,7 +865,35 @@ int main()
             }
 
             // Salva as reservas após confirmação
-            ControladorDeReservas::getInstancia()->salvarReservasEmArquivo("reservas.csv");
+            RoteadorDeReservas::getInstancia()->salvarReservas();
+
+            cout << "\nPressione ENTER para voltar ao menu...";
+            cin.get();
+        }
+
+        // ============================ BUSCAR POR CPF =========================
+        if (user_escolha == 5)
+        {
+            cin.ignore();
+            string cpfBusca;
+            cout << "Digite o CPF do cliente: ";
+            getline(cin, cpfBusca);
+
+            // Consulta todas as localidades em paralelo
+            const vector<Reserva> encontradas = RoteadorDeReservas::getInstancia()->buscarPorCpf(cpfBusca);
+
+            if (encontradas.empty())
+            {
+                cout << "Nenhuma reserva encontrada para o CPF \"" << cpfBusca << "\".\n";
+            }
+            else
+            {
+                cout << "===== Reservas do CPF " << cpfBusca << " =====\n";
+                for (const Reserva &r : encontradas)
+                {
+                    cout << r.getResumo() << "\n--------------------\n";
+                }
+            }
 
             cout << "\nPressione ENTER para voltar ao menu...";
             cin.get();
@@ -647,7 +903,7 @@ int main()
         if (user_escolha == 2)
         {
             Reserva::fazerReserva(autenticado);
-            ControladorDeReservas::getInstancia()->salvarReservasEmArquivo("reservas.csv");
+            RoteadorDeReservas::getInstancia()->salvarReservas();
 
             // Submenu após reservar
             while (true)
@@ -683,7 +939,7 @@ int main()
     // Salva as reservas antes de sair do sistema
     if (user_escolha == 3)
     {
-        ControladorDeReservas::getInstancia()->salvarReservasEmArquivo("reservas.csv");
+        RoteadorDeReservas::getInstancia()->salvarReservas();
         cout << "Saindo do sistema... Até logo!" << endl;
         return 0;
     }